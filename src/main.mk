@@ -26,10 +26,18 @@ SOURCES      := utility/runtime.C \
                 \
                 utility/types.C \
                 \
+                utility/kmers-cardinality.C \
+                utility/kmers-delta.C \
                 utility/kmers-exact.C \
+                utility/kmers-export.C \
                 utility/kmers-files.C \
                 utility/kmers-histogram.C \
+                utility/kmers-iterator.C \
                 utility/kmers-reader.C \
+                utility/kmers-scan.C \
+                utility/kmers-sketch.C \
+                utility/kmers-sort.C \
+                utility/kmers-spaced.C \
                 utility/kmers-writer-block.C \
                 utility/kmers-writer-stream.C \
                 utility/kmers-writer.C \
@@ -37,6 +45,7 @@ SOURCES      := utility/runtime.C \
                 \
                 utility/bits.C \
                 utility/bits-wordArray.C \
+                utility/bits-eliasFano.C \
                 \
                 utility/hexDump.C \
                 utility/md5.C \
@@ -85,6 +94,7 @@ SUBMAKEFILES += tests/alignTest-ssw.mk \
                 tests/filesTest.mk \
                 tests/intervalListTest.mk \
                 tests/intervalsTest.mk \
+                tests/kmersTest.mk \
                 tests/loggingTest.mk \
                 tests/magicNumber.mk \
                 tests/parasailTest.mk \